@@ -221,15 +221,77 @@
 	#define A5HASH_INLINE_F A5HASH_INLINE
 #endif // !defined( A5HASH_INLINE_F )
 
+/**
+ * @def A5HASH_INSTRUMENT( FuncName, MsgLen, Count )
+ * @brief Instrumentation macro, invoked as a statement on each call of
+ * a hash function, with the function's name (string literal), message
+ * length, and the number of messages hashed by the call. If this macro is
+ * defined externally, it can be used to collect the statistics of message
+ * lengths (e.g., in thread-local counters), for selection of the optimal
+ * hash function variant. By default, it is defined to do nothing.
+ *
+ * @param FuncName Hash function's name.
+ * @param MsgLen Message length, in bytes.
+ * @param Count The number of messages.
+ */
+
+#if !defined( A5HASH_INSTRUMENT )
+
+	#define A5HASH_INSTRUMENT( FuncName, MsgLen, Count )
+	#define A5HASH_INSTRUMENT_DEFAULT
+
+#endif // !defined( A5HASH_INSTRUMENT )
+
+/**
+ * @def A5HASH_LE_PORTABLE
+ * @brief If this macro is defined externally, the `a5hash_le()` and
+ * `a5hash128_le()` functions use endianness-independent byte loads on all
+ * platforms. This is useful for testing of the big-endian code path on
+ * little-endian systems.
+ */
+
+/**
+ * @def A5HASH_LITTLE_ENDIAN
+ * @brief Macro that denotes a little-endian platform.
+ */
+
+/**
+ * @def A5HASH_BIG_ENDIAN
+ * @brief Macro that denotes a big-endian platform with GCC-style built-in
+ * functions.
+ */
+
+#if !defined( A5HASH_LE_PORTABLE )
+	#if defined( __BYTE_ORDER__ ) && defined( __ORDER_LITTLE_ENDIAN__ )
+		#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+			#define A5HASH_LITTLE_ENDIAN
+
+		#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ && \
+			defined( A5HASH_GCC_BUILTINS )
+
+			#define A5HASH_BIG_ENDIAN
+
+		#endif // __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	#elif defined( _MSC_VER ) || defined( __i386__ ) || \
+		defined( __x86_64__ )
+
+		#define A5HASH_LITTLE_ENDIAN
+
+	#endif // defined( _MSC_VER )
+#endif // !defined( A5HASH_LE_PORTABLE )
+
 #if defined( A5HASH_NS )
 
 namespace A5HASH_NS {
 
+using std :: memcmp;
 using std :: memcpy;
 using std :: size_t;
 
 #if __cplusplus >= 201103L
 
+	using std :: uint16_t;
 	using std :: uint32_t;
 	using std :: uint64_t;
 	using uint8_t = unsigned char; ///< For C++ type aliasing compliance.
@@ -263,6 +325,78 @@ A5HASH_INLINE_F uint64_t a5hash_lu64( const uint8_t* const p ) A5HASH_NOEX
 
 /** @} */
 
+/**
+ * @{
+ * @brief Load unsigned little-endian value of the specific bit size from
+ * memory. On little-endian platforms, these functions are equivalent to
+ * native loads. On big-endian platforms, native loads are byte-swapped
+ * (which usually compiles into a single byte-reversing load instruction).
+ *
+ * @param p Load address.
+ */
+
+A5HASH_INLINE_F uint32_t a5hash_lu32le( const uint8_t* const p ) A5HASH_NOEX
+{
+#if defined( A5HASH_LITTLE_ENDIAN )
+
+	return( a5hash_lu32( p ));
+
+#elif defined( A5HASH_BIG_ENDIAN )
+
+	return( __builtin_bswap32( a5hash_lu32( p )));
+
+#else // defined( A5HASH_BIG_ENDIAN )
+
+	return( (uint32_t) p[ 0 ] | (uint32_t) p[ 1 ] << 8 |
+		(uint32_t) p[ 2 ] << 16 | (uint32_t) p[ 3 ] << 24 );
+
+#endif // defined( A5HASH_BIG_ENDIAN )
+}
+
+A5HASH_INLINE_F uint64_t a5hash_lu64le( const uint8_t* const p ) A5HASH_NOEX
+{
+#if defined( A5HASH_LITTLE_ENDIAN )
+
+	return( a5hash_lu64( p ));
+
+#elif defined( A5HASH_BIG_ENDIAN )
+
+	return( __builtin_bswap64( a5hash_lu64( p )));
+
+#else // defined( A5HASH_BIG_ENDIAN )
+
+	return( (uint64_t) a5hash_lu32le( p ) |
+		(uint64_t) a5hash_lu32le( p + 4 ) << 32 );
+
+#endif // defined( A5HASH_BIG_ENDIAN )
+}
+
+/** @} */
+
+/**
+ * @{
+ * @brief Load unsigned value of the specific bit size from memory, in the
+ * native or little-endian byte order.
+ *
+ * @param p Load address.
+ * @param UseLE Non-zero to use the little-endian byte order. Usually
+ * a compile-time constant.
+ */
+
+A5HASH_INLINE_F uint32_t a5hash_lu32e( const uint8_t* const p,
+	const int UseLE ) A5HASH_NOEX
+{
+	return( UseLE ? a5hash_lu32le( p ) : a5hash_lu32( p ));
+}
+
+A5HASH_INLINE_F uint64_t a5hash_lu64e( const uint8_t* const p,
+	const int UseLE ) A5HASH_NOEX
+{
+	return( UseLE ? a5hash_lu64le( p ) : a5hash_lu64( p ));
+}
+
+/** @} */
+
 /**
  * @brief 64-bit by 64-bit unsigned multiplication producing a 128-bit result.
  *
@@ -303,121 +437,686 @@ A5HASH_INLINE_F void a5hash_umul128( const uint64_t u, const uint64_t v,
 	*rl = u * v;
 	*rh = __mulhdu( u, v );
 
-#else // defined( __IBMC__ )
+#else // defined( __IBMC__ )
+
+	// _umul128() code for 32-bit systems, adapted from Hacker's Delight,
+	// Henry S. Warren, Jr.
+
+	*rl = u * v;
+
+	const uint32_t u0 = (uint32_t) u;
+	const uint32_t v0 = (uint32_t) v;
+	const uint64_t w0 = (uint64_t) u0 * v0;
+	const uint32_t u1 = (uint32_t) ( u >> 32 );
+	const uint32_t v1 = (uint32_t) ( v >> 32 );
+	const uint64_t t = (uint64_t) u1 * v0 + (uint32_t) ( w0 >> 32 );
+	const uint64_t w1 = (uint64_t) u0 * v1 + (uint32_t) t;
+
+	*rh = (uint64_t) u1 * v1 + (uint32_t) ( w1 >> 32 ) +
+		(uint32_t) ( t >> 32 );
+
+#endif // defined( __IBMC__ )
+}
+
+/**
+ * @brief A5HASH 64-bit hash function's finalization, which hashes the last
+ * 0 to 16 bytes of the message.
+ *
+ * @param Msg The message's tail to produce a hash from.
+ * @param MsgLen Tail's length, in bytes, in the range `[0; 16]`. Can be
+ * zero only if the whole message is empty.
+ * @param Seed1 Seed value 1.
+ * @param Seed2 Seed value 2.
+ * @param val01 The `val01` value, which was possibly updated by the message
+ * hashing.
+ * @param UseLE Non-zero to load message words in the little-endian byte
+ * order, instead of the native byte order.
+ * @return 64-bit hash of the input data.
+ */
+
+A5HASH_INLINE_F uint64_t a5hash_tail( const uint8_t* const Msg,
+	size_t MsgLen, uint64_t Seed1, uint64_t Seed2, const uint64_t val01,
+	const int UseLE ) A5HASH_NOEX
+{
+	if( MsgLen == 0 )
+	{
+		goto _fin;
+	}
+
+	if( MsgLen > 3 )
+	{
+		const uint8_t* Msg4;
+		size_t mo;
+
+		Msg4 = Msg + MsgLen - 4;
+		mo = MsgLen >> 3;
+
+		Seed1 ^= (uint64_t) a5hash_lu32e( Msg, UseLE ) << 32 |
+			a5hash_lu32e( Msg4, UseLE );
+
+		Seed2 ^= (uint64_t) a5hash_lu32e( Msg + mo * 4, UseLE ) << 32 |
+			a5hash_lu32e( Msg4 - mo * 4, UseLE );
+
+	_fin:
+		a5hash_umul128( Seed1, Seed2, &Seed1, &Seed2 );
+
+		a5hash_umul128( val01 ^ Seed1, Seed2, &Seed1, &Seed2 );
+
+		return( Seed1 ^ Seed2 );
+	}
+	else
+	{
+		Seed1 ^= Msg[ 0 ];
+
+		if( --MsgLen != 0 )
+		{
+			Seed1 ^= (uint64_t) Msg[ 1 ] << 8;
+
+			if( --MsgLen != 0 )
+			{
+				Seed1 ^= (uint64_t) Msg[ 2 ] << 16;
+			}
+		}
+
+		goto _fin;
+	}
+}
+
+/**
+ * @brief A5HASH 64-bit hash function's message hashing, which follows the
+ * initial seeding multiplication.
+ *
+ * @param Msg The message to produce a hash from. The alignment of this
+ * pointer is unimportant. It is valid to pass 0 when `MsgLen` equals 0.
+ * @param MsgLen Message length, in bytes, can be zero.
+ * @param Seed1 Seed value 1, after the initial seeding multiplication.
+ * @param Seed2 Seed value 2, after the initial seeding multiplication.
+ * @param UseLE Non-zero to load message words in the little-endian byte
+ * order, instead of the native byte order.
+ * @return 64-bit hash of the input data.
+ */
+
+A5HASH_INLINE_F uint64_t a5hash_msg( const uint8_t* Msg, size_t MsgLen,
+	uint64_t Seed1, uint64_t Seed2, const int UseLE ) A5HASH_NOEX
+{
+	uint64_t val01 = A5HASH_VAL01;
+	uint64_t val10 = A5HASH_VAL10;
+
+	if( MsgLen > 16 )
+	{
+		val01 ^= Seed1;
+		val10 ^= Seed2;
+
+		do
+		{
+			a5hash_umul128( (uint64_t) a5hash_lu32e( Msg, UseLE ) << 32 ^
+				a5hash_lu32e( Msg + 4, UseLE ) ^ Seed1,
+				(uint64_t) a5hash_lu32e( Msg + 8, UseLE ) << 32 ^
+				a5hash_lu32e( Msg + 12, UseLE ) ^ Seed2, &Seed1, &Seed2 );
+
+			MsgLen -= 16;
+			Msg += 16;
+
+			Seed1 += val01;
+			Seed2 += val10;
+
+		} while( MsgLen > 16 );
+	}
+
+	return( a5hash_tail( Msg, MsgLen, Seed1, Seed2, val01, UseLE ));
+}
+
+/**
+ * @brief A5HASH 64-bit hash function.
+ *
+ * Produces and returns a 64-bit hash value (digest) of the specified message,
+ * string, or binary data block. Designed for string/small key data hash-map
+ * and hash-table uses.
+ *
+ * @param Msg0 The message to produce a hash from. The alignment of this
+ * pointer is unimportant. It is valid to pass 0 when `MsgLen` equals 0.
+ * @param MsgLen Message length, in bytes, can be zero.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @return 64-bit hash of the input data.
+ */
+
+A5HASH_INLINE_F uint64_t a5hash( const void* const Msg0, size_t MsgLen,
+	const uint64_t UseSeed ) A5HASH_NOEX
+{
+	// The seeds are initialized to mantissa bits of PI.
+
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ MsgLen;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ MsgLen;
+
+	A5HASH_INSTRUMENT( "a5hash", MsgLen, 1 );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	return( a5hash_msg( (const uint8_t*) Msg0, MsgLen, Seed1, Seed2, 0 ));
+}
+
+/**
+ * @brief A5HASH 64-bit endianness-independent hash function.
+ *
+ * Produces and returns a 64-bit hash value of the specified message, which
+ * is the same on little- and big-endian platforms: the message is hashed as
+ * if loaded on a little-endian platform. On little-endian platforms, this
+ * function is equivalent to the `a5hash()` function. On big-endian
+ * platforms, it is a bit slower due to byte-swapping loads.
+ *
+ * @param Msg0 The message to produce a hash from. The alignment of this
+ * pointer is unimportant. It is valid to pass 0 when `MsgLen` equals 0.
+ * @param MsgLen Message length, in bytes, can be zero.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @return 64-bit hash of the input data.
+ */
+
+A5HASH_INLINE_F uint64_t a5hash_le( const void* const Msg0, size_t MsgLen,
+	const uint64_t UseSeed ) A5HASH_NOEX
+{
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ MsgLen;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ MsgLen;
+
+	A5HASH_INSTRUMENT( "a5hash_le", MsgLen, 1 );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	return( a5hash_msg( (const uint8_t*) Msg0, MsgLen, Seed1, Seed2, 1 ));
+}
+
+/**
+ * @brief A5HASH 64-bit hash function for UTF-16 strings.
+ *
+ * Produces and returns a 64-bit hash value of the UTF-8 representation of
+ * the specified UTF-16 string, which is equal to the `a5hash()` function's
+ * result for the UTF-8 string. The string is transcoded on the fly, without
+ * memory allocation: the first pass calculates the UTF-8 length (which is
+ * required by the hash function's initial state), and the second pass hashes
+ * the 16-byte blocks of the UTF-8 representation, as they are produced.
+ * Strings that consist of ASCII characters are transcoded in 8-character
+ * groups.
+ *
+ * Unpaired surrogates are encoded as the U+FFFD replacement character, like
+ * most UTF-16 to UTF-8 converters do.
+ *
+ * @param Str0 The UTF-16 string to produce a hash from, in the native byte
+ * order. The alignment of this pointer is unimportant. It is valid to pass 0
+ * when `StrLen` equals 0.
+ * @param StrLen String length, in 16-bit code units, can be zero.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @return 64-bit hash of the UTF-8 representation of the string.
+ */
+
+A5HASH_INLINE uint64_t a5hash_utf16( const void* const Str0,
+	const size_t StrLen, const uint64_t UseSeed ) A5HASH_NOEX
+{
+	const uint8_t* const Str = (const uint8_t*) Str0;
+	uint64_t val01 = A5HASH_VAL01;
+	uint64_t val10 = A5HASH_VAL10;
+	uint64_t Seed1, Seed2;
+	uint8_t Buf[ 32 ] = { 0 }; // Bytes not yet hashed, up to 23 bytes.
+	size_t MsgLen = 0; // UTF-8 length.
+	size_t Left; // The number of bytes not yet hashed, including `Buf`.
+	size_t Fill = 0;
+	size_t Pairs = 0;
+	size_t i;
+	uint16_t p = 0; // Previous code unit.
+
+	for( i = 0; i < StrLen; i++ )
+	{
+		uint16_t c;
+		memcpy( &c, Str + i * 2, 2 );
+
+		MsgLen += (size_t) ( 1 + ( c >= 0x80 ) + ( c >= 0x800 ));
+		Pairs += (size_t) ((( p & 0xFC00 ) == 0xD800 ) &
+			(( c & 0xFC00 ) == 0xDC00 ));
+
+		p = c;
+	}
+
+	MsgLen -= Pairs * 2; // Surrogate pairs take 4 bytes, not 6.
+	Left = MsgLen;
+
+	Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ MsgLen;
+	Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ MsgLen;
+
+	A5HASH_INSTRUMENT( "a5hash_utf16", MsgLen, 1 );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	if( MsgLen > 16 )
+	{
+		val01 ^= Seed1;
+		val10 ^= Seed2;
+	}
+
+	i = 0;
+
+	while( i < StrLen )
+	{
+		uint32_t c;
+
+		if( i + 8 <= StrLen && (( a5hash_lu64( Str + i * 2 ) |
+			a5hash_lu64( Str + i * 2 + 8 )) &
+			A5HASH_U64_C( 0xFF80FF80FF80FF80 )) == 0 )
+		{
+			uint16_t a[ 8 ];
+			size_t k;
+
+			memcpy( a, Str + i * 2, 16 );
+
+			for( k = 0; k < 8; k++ )
+			{
+				Buf[ Fill + k ] = (uint8_t) a[ k ];
+			}
+
+			Fill += 8;
+			i += 8;
+		}
+		else
+		{
+			uint8_t* const b = Buf + Fill;
+			uint16_t c16;
+
+			memcpy( &c16, Str + i * 2, 2 );
+			c = c16;
+			i++;
+
+			if( c < 0x80 )
+			{
+				b[ 0 ] = (uint8_t) c;
+				Fill++;
+			}
+			else if( c < 0x800 )
+			{
+				b[ 0 ] = (uint8_t) ( 0xC0 | c >> 6 );
+				b[ 1 ] = (uint8_t) ( 0x80 | ( c & 0x3F ));
+				Fill += 2;
+			}
+			else
+			{
+				if(( c & 0xFC00 ) == 0xD800 && i < StrLen )
+				{
+					memcpy( &c16, Str + i * 2, 2 );
+
+					if(( c16 & 0xFC00 ) == 0xDC00 )
+					{
+						c = 0x10000 + (( c & 0x3FF ) << 10 | ( c16 & 0x3FF ));
+						i++;
+
+						b[ 0 ] = (uint8_t) ( 0xF0 | c >> 18 );
+						b[ 1 ] = (uint8_t) ( 0x80 | ( c >> 12 & 0x3F ));
+						b[ 2 ] = (uint8_t) ( 0x80 | ( c >> 6 & 0x3F ));
+						b[ 3 ] = (uint8_t) ( 0x80 | ( c & 0x3F ));
+						Fill += 4;
+
+						goto _block;
+					}
+				}
+
+				if(( c & 0xF800 ) == 0xD800 )
+				{
+					c = 0xFFFD; // Unpaired surrogate.
+				}
+
+				b[ 0 ] = (uint8_t) ( 0xE0 | c >> 12 );
+				b[ 1 ] = (uint8_t) ( 0x80 | ( c >> 6 & 0x3F ));
+				b[ 2 ] = (uint8_t) ( 0x80 | ( c & 0x3F ));
+				Fill += 3;
+			}
+		}
+
+	_block:
+		if( Fill >= 16 && Left > 16 )
+		{
+			a5hash_umul128( (uint64_t) a5hash_lu32( Buf ) << 32 ^
+				a5hash_lu32( Buf + 4 ) ^ Seed1,
+				(uint64_t) a5hash_lu32( Buf + 8 ) << 32 ^
+				a5hash_lu32( Buf + 12 ) ^ Seed2, &Seed1, &Seed2 );
+
+			Seed1 += val01;
+			Seed2 += val10;
+
+			memcpy( Buf, Buf + 16, 8 );
+			Fill -= 16;
+			Left -= 16;
+		}
+	}
+
+	return( a5hash_tail( Buf, Left, Seed1, Seed2, val01, 0 ));
+}
+
+/**
+ * @brief A5HASH 64-bit hash function for 64-bit keys.
+ *
+ * Produces and returns a 64-bit hash value of the specified 64-bit key. This
+ * function is a faster equivalent of the `a5hash( &v, 8, UseSeed )` call,
+ * and produces the same hash value.
+ *
+ * @param v The key to produce a hash from.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @return 64-bit hash of the key.
+ */
+
+A5HASH_INLINE_F uint64_t a5hash_u64( const uint64_t v,
+	const uint64_t UseSeed ) A5HASH_NOEX
+{
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ 8;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ 8;
+	uint64_t a, b;
+	uint8_t m[ 8 ];
+
+	A5HASH_INSTRUMENT( "a5hash_u64", 8, 1 );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	memcpy( m, &v, 8 );
+	a = a5hash_lu32( m );
+	b = a5hash_lu32( m + 4 );
+
+	a5hash_umul128( Seed1 ^ ( a << 32 | b ), Seed2 ^ ( b << 32 | a ),
+		&Seed1, &Seed2 );
+
+	a5hash_umul128( A5HASH_VAL01 ^ Seed1, Seed2, &Seed1, &Seed2 );
+
+	return( Seed1 ^ Seed2 );
+}
+
+/**
+ * @brief A5HASH 64-bit hash function for arrays of 64-bit keys.
+ *
+ * Produces 64-bit hash values of the specified 64-bit keys, with each value
+ * being equal to the `a5hash_u64( Keys[ i ], UseSeed )` call's result. This
+ * function is designed for batch key hashing (e.g., in hash-join and
+ * hash-partitioning uses): since the seed's initial state is computed only
+ * once, a single key is hashed using 2 multiplications instead of 3. Hashes
+ * of different keys are independent, and can be computed in parallel by the
+ * processor.
+ *
+ * @param Keys The keys to produce hashes from. Can be 0 if `Count` equals 0.
+ * @param Count The number of keys, can be zero.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @param[out] Hashes Pointer to array that receives `Count` 64-bit hashes.
+ * Can point to the `Keys` array.
+ */
+
+A5HASH_INLINE void a5hash_u64_batch( const uint64_t* const Keys,
+	const size_t Count, const uint64_t UseSeed,
+	uint64_t* const Hashes ) A5HASH_NOEX
+{
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ 8;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ 8;
+	size_t i;
+
+	A5HASH_INSTRUMENT( "a5hash_u64_batch", 8, Count );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	for( i = 0; i < Count; i++ )
+	{
+		uint64_t s1, s2, a, b;
+		uint8_t m[ 8 ];
+
+		memcpy( m, Keys + i, 8 );
+		a = a5hash_lu32( m );
+		b = a5hash_lu32( m + 4 );
+
+		a5hash_umul128( Seed1 ^ ( a << 32 | b ), Seed2 ^ ( b << 32 | a ),
+			&s1, &s2 );
+
+		a5hash_umul128( A5HASH_VAL01 ^ s1, s2, &s1, &s2 );
+
+		Hashes[ i ] = s1 ^ s2;
+	}
+}
+
+/**
+ * @brief A5HASH 64-bit hash function for k-mers of a DNA sequence.
+ *
+ * Produces 64-bit hash values of all overlapping k-length windows (k-mers) of
+ * the specified nucleotide sequence. Each k-mer is packed into a 64-bit
+ * value using 2 bits per nucleotide (A=0, C=1, T=2, G=3, the first
+ * nucleotide in the highest bits), and the canonical k-mer, which is the
+ * smaller of the packed k-mer and its packed reverse complement, is hashed.
+ * The hash value is equal to the `a5hash_u64( CanonicalKmer, UseSeed )`
+ * call's result, so a k-mer and its reverse complement produce the same hash
+ * value. Packed k-mers are updated incrementally, at a cost of a few
+ * logical operations per nucleotide, and the seed's initial state is
+ * computed only once. The resulting hashes can be used for (w,k)-minimizer
+ * selection, as a sliding-window minimum over `w` adjacent hash values.
+ *
+ * @param Seq0 The sequence of nucleotide characters (ASCII `A`, `C`, `G`,
+ * `T`, in any case). Other characters (e.g., `N`) are mapped to one of the
+ * four nucleotides, so ambiguous regions should be excluded by the caller.
+ * Can be 0 if `SeqLen` is less than `k`.
+ * @param SeqLen Sequence length, in characters, can be zero.
+ * @param k k-mer length, in nucleotides, 1 to 32. Other values produce no
+ * hashes.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @param[out] Hashes Pointer to array that receives `SeqLen - k + 1` 64-bit
+ * hashes, with the hash at index `i` corresponding to the k-mer that starts
+ * at position `i`.
+ * @return The number of hashes produced, 0 if `SeqLen` is less than `k`, or
+ * if `k` is out of range.
+ */
+
+A5HASH_INLINE size_t a5hash_kmers( const void* const Seq0,
+	const size_t SeqLen, const size_t k, const uint64_t UseSeed,
+	uint64_t* const Hashes ) A5HASH_NOEX
+{
+	const uint8_t* const Seq = (const uint8_t*) Seq0;
+	uint64_t Mask;
+	int rcs; // Reverse complement's insertion shift.
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ 8;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ 8;
+	uint64_t f = 0; // Packed k-mer.
+	uint64_t r = 0; // Packed reverse complement of the k-mer.
+	size_t i;
+
+	if( k == 0 || k > 32 || SeqLen < k )
+	{
+		return( 0 );
+	}
+
+	Mask = ~(uint64_t) 0 >> ( 64 - k * 2 );
+	rcs = (int) ( k * 2 - 2 );
+
+	A5HASH_INSTRUMENT( "a5hash_kmers", 8, SeqLen - k + 1 );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	for( i = 0; i < k - 1; i++ )
+	{
+		const uint64_t c = Seq[ i ] >> 1 & 3;
+
+		f = f << 2 | c;
+		r = r >> 2 | ( c ^ 2 ) << rcs;
+	}
+
+	for( ; i < SeqLen; i++ )
+	{
+		const uint64_t c = Seq[ i ] >> 1 & 3;
+		uint64_t v, s1, s2, a, b;
+		uint8_t m[ 8 ];
+
+		f = ( f << 2 | c ) & Mask;
+		r = r >> 2 | ( c ^ 2 ) << rcs;
+		v = ( f < r ? f : r );
 
-	// _umul128() code for 32-bit systems, adapted from Hacker's Delight,
-	// Henry S. Warren, Jr.
+		memcpy( m, &v, 8 );
+		a = a5hash_lu32( m );
+		b = a5hash_lu32( m + 4 );
 
-	*rl = u * v;
+		a5hash_umul128( Seed1 ^ ( a << 32 | b ), Seed2 ^ ( b << 32 | a ),
+			&s1, &s2 );
 
-	const uint32_t u0 = (uint32_t) u;
-	const uint32_t v0 = (uint32_t) v;
-	const uint64_t w0 = (uint64_t) u0 * v0;
-	const uint32_t u1 = (uint32_t) ( u >> 32 );
-	const uint32_t v1 = (uint32_t) ( v >> 32 );
-	const uint64_t t = (uint64_t) u1 * v0 + (uint32_t) ( w0 >> 32 );
-	const uint64_t w1 = (uint64_t) u0 * v1 + (uint32_t) t;
+		a5hash_umul128( A5HASH_VAL01 ^ s1, s2, &s1, &s2 );
 
-	*rh = (uint64_t) u1 * v1 + (uint32_t) ( w1 >> 32 ) +
-		(uint32_t) ( t >> 32 );
+		Hashes[ i + 1 - k ] = s1 ^ s2;
+	}
 
-#endif // defined( __IBMC__ )
+	return( SeqLen - k + 1 );
 }
 
 /**
- * @brief A5HASH 64-bit hash function.
+ * @brief A5HASH 64-bit hash function for arrays of fixed-length keys.
  *
- * Produces and returns a 64-bit hash value (digest) of the specified message,
- * string, or binary data block. Designed for string/small key data hash-map
- * and hash-table uses.
+ * Produces 64-bit hash values of the specified fixed-length keys, with each
+ * value being equal to the `a5hash( Msg + Stride * i, MsgLen, UseSeed )`
+ * call's result. This function is designed for column or record batch
+ * hashing (e.g., in hash aggregation uses): since the seed's initial state
+ * is computed only once, a single key is hashed using one multiplication
+ * less than with the `a5hash()` function. If `MsgLen` is a compile-time
+ * constant, the key-length branching is resolved at compile time.
  *
- * @param Msg0 The message to produce a hash from. The alignment of this
- * pointer is unimportant. It is valid to pass 0 when `MsgLen` equals 0.
- * @param MsgLen Message length, in bytes, can be zero.
+ * @param Msg0 The keys to produce hashes from. The alignment of this pointer
+ * is unimportant. Can be 0 if `Count` equals 0.
+ * @param Stride The distance between adjacent keys, in bytes, usually equal
+ * to or larger than `MsgLen`.
+ * @param MsgLen Key length, in bytes, can be zero.
+ * @param Count The number of keys, can be zero.
  * @param UseSeed An optional value to use instead of the default seed (0).
  * This value can have any number of significant bits and any statistical
  * quality.
- * @return 64-bit hash of the input data.
+ * @param[out] Hashes Pointer to array that receives `Count` 64-bit hashes.
  */
 
-A5HASH_INLINE_F uint64_t a5hash( const void* const Msg0, size_t MsgLen,
-	const uint64_t UseSeed ) A5HASH_NOEX
+A5HASH_INLINE_F void a5hash_batch( const void* const Msg0,
+	const size_t Stride, const size_t MsgLen, const size_t Count,
+	const uint64_t UseSeed, uint64_t* const Hashes ) A5HASH_NOEX
 {
 	const uint8_t* Msg = (const uint8_t*) Msg0;
-
-	uint64_t val01 = A5HASH_VAL01;
-	uint64_t val10 = A5HASH_VAL10;
-
-	// The seeds are initialized to mantissa bits of PI.
-
 	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ MsgLen;
 	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ MsgLen;
+	size_t i;
 
-	a5hash_umul128( Seed2 ^ ( UseSeed & val10 ),
-		Seed1 ^ ( UseSeed & val01 ), &Seed1, &Seed2 );
-
-	if( MsgLen > 16 )
-	{
-		val01 ^= Seed1;
-		val10 ^= Seed2;
+	A5HASH_INSTRUMENT( "a5hash_batch", MsgLen, Count );
 
-		do
-		{
-			a5hash_umul128( (uint64_t) a5hash_lu32( Msg ) << 32 ^
-				a5hash_lu32( Msg + 4 ) ^ Seed1,
-				(uint64_t) a5hash_lu32( Msg + 8 ) << 32 ^
-				a5hash_lu32( Msg + 12 ) ^ Seed2, &Seed1, &Seed2 );
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
 
-			MsgLen -= 16;
-			Msg += 16;
+	for( i = 0; i < Count; i++ )
+	{
+		Hashes[ i ] = a5hash_msg( Msg, MsgLen, Seed1, Seed2, 0 );
+		Msg += Stride;
+	}
+}
 
-			Seed1 += val01;
-			Seed2 += val10;
+/**
+ * @brief A5HASH 64-bit symmetric hash function for IPv4 flows.
+ *
+ * Produces and returns a 64-bit hash value of the specified IPv4 5-tuple,
+ * which is the same for both directions of a connection. The endpoints are
+ * ordered, and the result is equal to the `a5hash()` function's result for
+ * the 13-byte message: lower endpoint's address, higher endpoint's address,
+ * lower endpoint's port, higher endpoint's port, protocol number.
+ *
+ * @param SrcAddr Pointer to 4-byte source address, usually in the network
+ * byte order, as stored in a packet header. The alignment of this pointer is
+ * unimportant.
+ * @param DstAddr Pointer to 4-byte destination address.
+ * @param SrcPort Source port, in any byte order, consistently used.
+ * @param DstPort Destination port.
+ * @param Proto Protocol number.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @return 64-bit hash of the flow.
+ */
 
-		} while( MsgLen > 16 );
-	}
+A5HASH_INLINE_F uint64_t a5hash_flow4( const void* const SrcAddr,
+	const void* const DstAddr, const uint16_t SrcPort, const uint16_t DstPort,
+	const uint8_t Proto, const uint64_t UseSeed ) A5HASH_NOEX
+{
+	const uint32_t sa = a5hash_lu32( (const uint8_t*) SrcAddr );
+	const uint32_t da = a5hash_lu32( (const uint8_t*) DstAddr );
+	uint8_t m[ 13 ];
 
-	if( MsgLen == 0 )
+	if( sa < da || ( sa == da && SrcPort <= DstPort ))
 	{
-		goto _fin;
+		memcpy( m, SrcAddr, 4 );
+		memcpy( m + 4, DstAddr, 4 );
+		memcpy( m + 8, &SrcPort, 2 );
+		memcpy( m + 10, &DstPort, 2 );
 	}
-
-	if( MsgLen > 3 )
+	else
 	{
-		const uint8_t* Msg4;
-		size_t mo;
-
-		Msg4 = Msg + MsgLen - 4;
-		mo = MsgLen >> 3;
+		memcpy( m, DstAddr, 4 );
+		memcpy( m + 4, SrcAddr, 4 );
+		memcpy( m + 8, &DstPort, 2 );
+		memcpy( m + 10, &SrcPort, 2 );
+	}
 
-		Seed1 ^= (uint64_t) a5hash_lu32( Msg ) << 32 | a5hash_lu32( Msg4 );
+	m[ 12 ] = Proto;
 
-		Seed2 ^= (uint64_t) a5hash_lu32( Msg + mo * 4 ) << 32 |
-			a5hash_lu32( Msg4 - mo * 4 );
+	return( a5hash( m, 13, UseSeed ));
+}
 
-	_fin:
-		a5hash_umul128( Seed1, Seed2, &Seed1, &Seed2 );
+/**
+ * @brief A5HASH 64-bit symmetric hash function for IPv6 flows.
+ *
+ * Produces and returns a 64-bit hash value of the specified IPv6 5-tuple,
+ * which is the same for both directions of a connection. The endpoints are
+ * ordered, and the result is equal to the `a5hash()` function's result for
+ * the 37-byte message: lower endpoint's address, higher endpoint's address,
+ * lower endpoint's port, higher endpoint's port, protocol number.
+ *
+ * @param SrcAddr Pointer to 16-byte source address, usually in the network
+ * byte order, as stored in a packet header. The alignment of this pointer is
+ * unimportant.
+ * @param DstAddr Pointer to 16-byte destination address.
+ * @param SrcPort Source port, in any byte order, consistently used.
+ * @param DstPort Destination port.
+ * @param Proto Protocol number (next header).
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @return 64-bit hash of the flow.
+ */
 
-		a5hash_umul128( val01 ^ Seed1, Seed2, &Seed1, &Seed2 );
+A5HASH_INLINE_F uint64_t a5hash_flow6( const void* const SrcAddr,
+	const void* const DstAddr, const uint16_t SrcPort, const uint16_t DstPort,
+	const uint8_t Proto, const uint64_t UseSeed ) A5HASH_NOEX
+{
+	const int c = memcmp( SrcAddr, DstAddr, 16 );
+	uint8_t m[ 37 ];
 
-		return( Seed1 ^ Seed2 );
+	if( c < 0 || ( c == 0 && SrcPort <= DstPort ))
+	{
+		memcpy( m, SrcAddr, 16 );
+		memcpy( m + 16, DstAddr, 16 );
+		memcpy( m + 32, &SrcPort, 2 );
+		memcpy( m + 34, &DstPort, 2 );
 	}
 	else
 	{
-		Seed1 ^= Msg[ 0 ];
-
-		if( --MsgLen != 0 )
-		{
-			Seed1 ^= (uint64_t) Msg[ 1 ] << 8;
+		memcpy( m, DstAddr, 16 );
+		memcpy( m + 16, SrcAddr, 16 );
+		memcpy( m + 32, &DstPort, 2 );
+		memcpy( m + 34, &SrcPort, 2 );
+	}
 
-			if( --MsgLen != 0 )
-			{
-				Seed1 ^= (uint64_t) Msg[ 2 ] << 16;
-			}
-		}
+	m[ 36 ] = Proto;
 
-		goto _fin;
-	}
+	return( a5hash( m, 37, UseSeed ));
 }
 
 /**
@@ -472,6 +1171,8 @@ A5HASH_INLINE_F uint32_t a5hash32( const void* const Msg0, size_t MsgLen,
 	uint32_t Seed3, Seed4;
 	uint32_t a, b, c, d;
 
+	A5HASH_INSTRUMENT( "a5hash32", MsgLen, 1 );
+
 	#if SIZE_MAX <= 0xFFFFFFFFU
 
 		Seed3 = 0xFB0BD3EA;
@@ -582,42 +1283,31 @@ _fin:
 }
 
 /**
- * @brief A5HASH 128-bit hash function.
- *
- * Produces and returns a 128-bit hash value (digest) of the specified
- * message, string, or binary data block. Designed for string/small key data
- * hash-map and hash-table uses.
+ * @brief A5HASH 128-bit hash function's message hashing, which follows the
+ * initial seeding multiplication.
  *
- * @param Msg0 The message to produce a hash from. The alignment of this
+ * @param Msg The message to produce a hash from. The alignment of this
  * pointer is unimportant. It is valid to pass 0 when `MsgLen` equals 0.
  * @param MsgLen Message length, in bytes, can be zero.
- * @param UseSeed An optional value to use instead of the default seed (0).
- * This value can have any number of significant bits and any statistical
- * quality.
+ * @param Seed1 Seed value 1, after the initial seeding multiplication.
+ * @param Seed2 Seed value 2, after the initial seeding multiplication.
  * @param[out] rh Pointer to 64-bit variable that receives upper 64 bits of
  * 128-bit hash. The alignment of this pointer is unimportant. Can be 0.
+ * @param UseLE Non-zero to load message words in the little-endian byte
+ * order, instead of the native byte order.
  * @return Lower 64 bits of 128-bit hash of the input data.
  */
 
-A5HASH_INLINE uint64_t a5hash128( const void* const Msg0, size_t MsgLen,
-	const uint64_t UseSeed, void* const rh ) A5HASH_NOEX
+A5HASH_INLINE_F uint64_t a5hash128_msg( const uint8_t* Msg, size_t MsgLen,
+	uint64_t Seed1, uint64_t Seed2, void* const rh,
+	const int UseLE ) A5HASH_NOEX
 {
-	const uint8_t* Msg = (const uint8_t*) Msg0;
-
 	uint64_t val01 = A5HASH_VAL01;
 	uint64_t val10 = A5HASH_VAL10;
-
-	// The seeds are initialized to mantissa bits of PI.
-
-	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ MsgLen;
-	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ MsgLen;
 	uint64_t Seed3 = A5HASH_U64_C( 0xA4093822299F31D0 );
 	uint64_t Seed4 = A5HASH_U64_C( 0xC0AC29B7C97C50DD );
 	uint64_t a, b, c, d;
 
-	a5hash_umul128( Seed2 ^ ( UseSeed & val10 ),
-		Seed1 ^ ( UseSeed & val01 ), &Seed1, &Seed2 );
-
 	if( MsgLen < 17 )
 	{
 		if( MsgLen > 3 )
@@ -628,10 +1318,11 @@ A5HASH_INLINE uint64_t a5hash128( const void* const Msg0, size_t MsgLen,
 			Msg4 = Msg + MsgLen - 4;
 			mo = MsgLen >> 3;
 
-			a = (uint64_t) a5hash_lu32( Msg ) << 32 | a5hash_lu32( Msg4 );
+			a = (uint64_t) a5hash_lu32e( Msg, UseLE ) << 32 |
+				a5hash_lu32e( Msg4, UseLE );
 
-			b = (uint64_t) a5hash_lu32( Msg + mo * 4 ) << 32 |
-				a5hash_lu32( Msg4 - mo * 4 );
+			b = (uint64_t) a5hash_lu32e( Msg + mo * 4, UseLE ) << 32 |
+				a5hash_lu32e( Msg4 - mo * 4, UseLE );
 
 		_fin16:
 			a5hash_umul128( a + Seed1, b + Seed2, &Seed1, &Seed2 );
@@ -676,13 +1367,17 @@ A5HASH_INLINE uint64_t a5hash128( const void* const Msg0, size_t MsgLen,
 
 	if( MsgLen < 33 )
 	{
-		a = (uint64_t) a5hash_lu32( Msg ) << 32 | a5hash_lu32( Msg + 4 );
-		b = (uint64_t) a5hash_lu32( Msg + 8 ) << 32 | a5hash_lu32( Msg + 12 );
-		c = (uint64_t) a5hash_lu32( Msg + MsgLen - 16 ) << 32 |
-			a5hash_lu32( Msg + MsgLen - 12 );
+		a = (uint64_t) a5hash_lu32e( Msg, UseLE ) << 32 |
+			a5hash_lu32e( Msg + 4, UseLE );
+
+		b = (uint64_t) a5hash_lu32e( Msg + 8, UseLE ) << 32 |
+			a5hash_lu32e( Msg + 12, UseLE );
+
+		c = (uint64_t) a5hash_lu32e( Msg + MsgLen - 16, UseLE ) << 32 |
+			a5hash_lu32e( Msg + MsgLen - 12, UseLE );
 
-		d = (uint64_t) a5hash_lu32( Msg + MsgLen - 8 ) << 32 |
-			a5hash_lu32( Msg + MsgLen - 4 );
+		d = (uint64_t) a5hash_lu32e( Msg + MsgLen - 8, UseLE ) << 32 |
+			a5hash_lu32e( Msg + MsgLen - 4, UseLE );
 
 	_fin_m:
 		a5hash_umul128( c + Seed3, d + Seed4, &Seed3, &Seed4 );
@@ -725,23 +1420,27 @@ A5HASH_INLINE uint64_t a5hash128( const void* const Msg0, size_t MsgLen,
 				const uint64_t s3 = Seed3;
 				const uint64_t s5 = Seed5;
 
-				a5hash_umul128( a5hash_lu64( Msg ) + Seed1,
-					a5hash_lu64( Msg + 32 ) + Seed2, &Seed1, &Seed2 );
+				a5hash_umul128( a5hash_lu64e( Msg, UseLE ) + Seed1,
+					a5hash_lu64e( Msg + 32, UseLE ) + Seed2,
+					&Seed1, &Seed2 );
 
 				Seed1 += val01;
 				Seed2 += Seed8;
 
-				a5hash_umul128( a5hash_lu64( Msg + 8 ) + Seed3,
-					a5hash_lu64( Msg + 40 ) + Seed4, &Seed3, &Seed4 );
+				a5hash_umul128( a5hash_lu64e( Msg + 8, UseLE ) + Seed3,
+					a5hash_lu64e( Msg + 40, UseLE ) + Seed4,
+					&Seed3, &Seed4 );
 
 				Seed3 += s1;
 				Seed4 += val10;
 
-				a5hash_umul128( a5hash_lu64( Msg + 16 ) + Seed5,
-					a5hash_lu64( Msg + 48 ) + Seed6, &Seed5, &Seed6 );
+				a5hash_umul128( a5hash_lu64e( Msg + 16, UseLE ) + Seed5,
+					a5hash_lu64e( Msg + 48, UseLE ) + Seed6,
+					&Seed5, &Seed6 );
 
-				a5hash_umul128( a5hash_lu64( Msg + 24 ) + Seed7,
-					a5hash_lu64( Msg + 56 ) + Seed8, &Seed7, &Seed8 );
+				a5hash_umul128( a5hash_lu64e( Msg + 24, UseLE ) + Seed7,
+					a5hash_lu64e( Msg + 56, UseLE ) + Seed8,
+					&Seed7, &Seed8 );
 
 				MsgLen -= 64;
 				Msg += 64;
@@ -770,14 +1469,14 @@ A5HASH_INLINE uint64_t a5hash128( const void* const Msg0, size_t MsgLen,
 		_tail32:
 			s1 = Seed1;
 
-			a5hash_umul128( a5hash_lu64( Msg ) + Seed1,
-				a5hash_lu64( Msg + 8 ) + Seed2, &Seed1, &Seed2 );
+			a5hash_umul128( a5hash_lu64e( Msg, UseLE ) + Seed1,
+				a5hash_lu64e( Msg + 8, UseLE ) + Seed2, &Seed1, &Seed2 );
 
 			Seed1 += val01;
 			Seed2 += Seed4;
 
-			a5hash_umul128( a5hash_lu64( Msg + 16 ) + Seed3,
-				a5hash_lu64( Msg + 24 ) + Seed4, &Seed3, &Seed4 );
+			a5hash_umul128( a5hash_lu64e( Msg + 16, UseLE ) + Seed3,
+				a5hash_lu64e( Msg + 24, UseLE ) + Seed4, &Seed3, &Seed4 );
 
 			MsgLen -= 32;
 			Msg += 32;
@@ -786,21 +1485,137 @@ A5HASH_INLINE uint64_t a5hash128( const void* const Msg0, size_t MsgLen,
 			Seed4 += val10;
 		}
 
-		a = a5hash_lu64( Msg + MsgLen - 16 );
-		b = a5hash_lu64( Msg + MsgLen - 8 );
+		a = a5hash_lu64e( Msg + MsgLen - 16, UseLE );
+		b = a5hash_lu64e( Msg + MsgLen - 8, UseLE );
 
 		if( MsgLen < 17 )
 		{
 			goto _fin;
 		}
 
-		c = a5hash_lu64( Msg + MsgLen - 32 );
-		d = a5hash_lu64( Msg + MsgLen - 24 );
+		c = a5hash_lu64e( Msg + MsgLen - 32, UseLE );
+		d = a5hash_lu64e( Msg + MsgLen - 24, UseLE );
 
 		goto _fin_m;
 	}
 }
 
+/**
+ * @brief A5HASH 128-bit hash function.
+ *
+ * Produces and returns a 128-bit hash value (digest) of the specified
+ * message, string, or binary data block. Designed for string/small key data
+ * hash-map and hash-table uses.
+ *
+ * @param Msg0 The message to produce a hash from. The alignment of this
+ * pointer is unimportant. It is valid to pass 0 when `MsgLen` equals 0.
+ * @param MsgLen Message length, in bytes, can be zero.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @param[out] rh Pointer to 64-bit variable that receives upper 64 bits of
+ * 128-bit hash. The alignment of this pointer is unimportant. Can be 0.
+ * @return Lower 64 bits of 128-bit hash of the input data.
+ */
+
+A5HASH_INLINE uint64_t a5hash128( const void* const Msg0,
+	const size_t MsgLen, const uint64_t UseSeed, void* const rh ) A5HASH_NOEX
+{
+	// The seeds are initialized to mantissa bits of PI.
+
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ MsgLen;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ MsgLen;
+
+	A5HASH_INSTRUMENT( "a5hash128", MsgLen, 1 );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	return( a5hash128_msg( (const uint8_t*) Msg0, MsgLen, Seed1, Seed2, rh,
+		0 ));
+}
+
+/**
+ * @brief A5HASH 128-bit endianness-independent hash function.
+ *
+ * Produces and returns a 128-bit hash value of the specified message, which
+ * is the same on little- and big-endian platforms: the message is hashed as
+ * if loaded on a little-endian platform. On little-endian platforms, this
+ * function is equivalent to the `a5hash128()` function. On big-endian
+ * platforms, it is a bit slower due to byte-swapping loads.
+ *
+ * @param Msg0 The message to produce a hash from. The alignment of this
+ * pointer is unimportant. It is valid to pass 0 when `MsgLen` equals 0.
+ * @param MsgLen Message length, in bytes, can be zero.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @param[out] rh Pointer to 64-bit variable that receives upper 64 bits of
+ * 128-bit hash. The alignment of this pointer is unimportant. Can be 0.
+ * @return Lower 64 bits of 128-bit hash of the input data.
+ */
+
+A5HASH_INLINE uint64_t a5hash128_le( const void* const Msg0,
+	const size_t MsgLen, const uint64_t UseSeed, void* const rh ) A5HASH_NOEX
+{
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ MsgLen;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ MsgLen;
+
+	A5HASH_INSTRUMENT( "a5hash128_le", MsgLen, 1 );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	return( a5hash128_msg( (const uint8_t*) Msg0, MsgLen, Seed1, Seed2, rh,
+		1 ));
+}
+
+/**
+ * @brief A5HASH 128-bit hash function for arrays of fixed-length keys.
+ *
+ * Produces 128-bit hash values of the specified fixed-length keys, with each
+ * value being equal to the `a5hash128( Msg + Stride * i, MsgLen, UseSeed,
+ * rh )` call's result. This function is designed for batch key hashing
+ * (e.g., in Bloom filter building): since the seed's initial state is
+ * computed only once, a single key is hashed using one multiplication less
+ * than with the `a5hash128()` function.
+ *
+ * @param Msg0 The keys to produce hashes from. The alignment of this pointer
+ * is unimportant. Can be 0 if `Count` equals 0.
+ * @param Stride The distance between adjacent keys, in bytes, usually equal
+ * to or larger than `MsgLen`.
+ * @param MsgLen Key length, in bytes, can be zero.
+ * @param Count The number of keys, can be zero.
+ * @param UseSeed An optional value to use instead of the default seed (0).
+ * This value can have any number of significant bits and any statistical
+ * quality.
+ * @param[out] Hashes Pointer to array that receives `Count` 128-bit hashes,
+ * as pairs of lower and upper 64-bit halves (`Count * 2` values).
+ */
+
+A5HASH_INLINE void a5hash128_batch( const void* const Msg0,
+	const size_t Stride, const size_t MsgLen, const size_t Count,
+	const uint64_t UseSeed, uint64_t* const Hashes ) A5HASH_NOEX
+{
+	const uint8_t* Msg = (const uint8_t*) Msg0;
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ MsgLen;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ MsgLen;
+	size_t i;
+
+	A5HASH_INSTRUMENT( "a5hash128_batch", MsgLen, Count );
+
+	a5hash_umul128( Seed2 ^ ( UseSeed & A5HASH_VAL10 ),
+		Seed1 ^ ( UseSeed & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	for( i = 0; i < Count; i++ )
+	{
+		Hashes[ i * 2 ] = a5hash128_msg( Msg, MsgLen, Seed1, Seed2,
+			Hashes + i * 2 + 1, 0 );
+
+		Msg += Stride;
+	}
+}
+
 /**
  * @brief A5RAND 64-bit pseudo-random number generator.
  *
@@ -832,6 +1647,181 @@ A5HASH_INLINE_F uint64_t a5rand( uint64_t* const Seed1,
 	return( s1 ^ s2 );
 }
 
+/**
+ * @brief Hash value range reduction.
+ *
+ * Maps a hash value to the range `[0; n - 1]`, by taking the upper half of
+ * the 128-bit product of the hash value and `n` (D. Lemire's "fastrange"
+ * method). This is a division-free replacement for the `h % n` operation,
+ * usable with any `n`, not only powers of 2. The result depends mostly on
+ * the upper bits of the hash value.
+ *
+ * @param h Hash value, e.g., produced by the `a5hash()` function.
+ * @param n The size of the range. If 0, the function returns 0.
+ * @return Reduced value, in the range `[0; n - 1]`.
+ */
+
+A5HASH_INLINE_F uint64_t a5hash_reduce( const uint64_t h,
+	const uint64_t n ) A5HASH_NOEX
+{
+	uint64_t rl, rh;
+	a5hash_umul128( h, n, &rl, &rh );
+
+	return( rh );
+}
+
+/**
+ * @brief Hash value range reduction, for arrays of hash values.
+ *
+ * Produces `a5hash_reduce( Hashes[ i ], n )` values for all hash values.
+ *
+ * @param Hashes Hash values. Can be 0 if `Count` equals 0.
+ * @param Count The number of hash values, can be zero.
+ * @param n The size of the range.
+ * @param[out] Out Pointer to array that receives `Count` reduced values. Can
+ * point to the `Hashes` array.
+ */
+
+A5HASH_INLINE void a5hash_reduce_batch( const uint64_t* const Hashes,
+	const size_t Count, const uint64_t n, uint64_t* const Out ) A5HASH_NOEX
+{
+	size_t i;
+
+	for( i = 0; i < Count; i++ )
+	{
+		Out[ i ] = a5hash_reduce( Hashes[ i ], n );
+	}
+}
+
+/**
+ * @brief Hash value splitting into an index and a tag (fingerprint).
+ *
+ * Produces a power-of-2 range index from the upper `IndexBits` bits of the
+ * hash value, and a 16-bit tag from the lower 16 bits of the hash value. The
+ * index and the tag use non-overlapping bits, and are thus statistically
+ * independent, if `IndexBits` is not greater than 48. 7- or 8-bit tags can be
+ * obtained by masking the lower bits of the 16-bit tag.
+ *
+ * @param h Hash value, e.g., produced by the `a5hash()` function.
+ * @param IndexBits The number of index bits, in the range `[1; 48]`.
+ * @param[out] Tag Pointer to variable that receives the 16-bit tag.
+ * @return Index, in the range `[0; 2^IndexBits - 1]`.
+ */
+
+A5HASH_INLINE_F uint64_t a5hash_split( const uint64_t h, const int IndexBits,
+	uint16_t* const Tag ) A5HASH_NOEX
+{
+	*Tag = (uint16_t) h;
+
+	return( h >> ( 64 - IndexBits ));
+}
+
+/**
+ * @brief Hash value splitting into an index and a tag, for arrays of hash
+ * values.
+ *
+ * Produces `a5hash_split( Hashes[ i ], IndexBits, Tags + i )` values for all
+ * hash values. This loop can be vectorized by the compiler.
+ *
+ * @param Hashes Hash values. Can be 0 if `Count` equals 0.
+ * @param Count The number of hash values, can be zero.
+ * @param IndexBits The number of index bits, in the range `[1; 48]`.
+ * @param[out] Indices Pointer to array that receives `Count` indices. Can
+ * point to the `Hashes` array.
+ * @param[out] Tags Pointer to array that receives `Count` 16-bit tags.
+ */
+
+A5HASH_INLINE void a5hash_split_batch( const uint64_t* const Hashes,
+	const size_t Count, const int IndexBits, uint64_t* const Indices,
+	uint16_t* const Tags ) A5HASH_NOEX
+{
+	size_t i;
+
+	for( i = 0; i < Count; i++ )
+	{
+		const uint64_t h = Hashes[ i ];
+
+		Tags[ i ] = (uint16_t) h;
+		Indices[ i ] = h >> ( 64 - IndexBits );
+	}
+}
+
+/**
+ * @brief Jump consistent hash function.
+ *
+ * Maps a key's hash value to one of the `BucketCount` buckets, using
+ * the "jump consistent hash" algorithm by John Lamping and Eric Veach, with
+ * the `a5rand()` PRNG as a source of random numbers. When the number of
+ * buckets changes from `n` to `n + 1`, only about `1 / ( n + 1 )` of keys
+ * are remapped, all to the new bucket. The expected number of iterations is
+ * `ln( BucketCount )`.
+ *
+ * @param KeyHash Key's hash value, e.g., produced by the `a5hash()` function.
+ * @param BucketCount The number of buckets. Values 0 and 1 both produce 0.
+ * @return Bucket index, in the range `[0; BucketCount - 1]`.
+ */
+
+A5HASH_INLINE uint32_t a5hash_jump( const uint64_t KeyHash,
+	const uint32_t BucketCount ) A5HASH_NOEX
+{
+	uint64_t Seed1 = KeyHash;
+	uint64_t Seed2 = KeyHash;
+	uint64_t b, j = 0;
+
+	do
+	{
+		b = j;
+		j = ( b + 1 ) * ( A5HASH_U64_C( 1 ) << 31 ) /
+			(( a5rand( &Seed1, &Seed2 ) >> 33 ) + 1 );
+
+	} while( j < BucketCount );
+
+	return( (uint32_t) b );
+}
+
+/**
+ * @brief Rendezvous (highest random weight) hash function.
+ *
+ * Selects a node for a key by finding the node with the highest
+ * `a5hash_u64( NodeIds[ i ], KeyHash )` score. When a node is removed,
+ * only keys that were assigned to it are remapped; when a node is added,
+ * only keys that get assigned to it are remapped. Since the seed's initial
+ * state is computed once per call, each node is scored using 2
+ * multiplications.
+ *
+ * @param KeyHash Key's hash value, e.g., produced by the `a5hash()` function.
+ * @param NodeIds Unique node identifiers. Can be 0 if `NodeCount` equals 0.
+ * @param NodeCount The number of nodes, can be zero.
+ * @return Index of the selected node, or 0 if `NodeCount` equals 0.
+ */
+
+A5HASH_INLINE size_t a5hash_rendezvous( const uint64_t KeyHash,
+	const uint64_t* const NodeIds, const size_t NodeCount ) A5HASH_NOEX
+{
+	uint64_t Seed1 = A5HASH_U64_C( 0x243F6A8885A308D3 ) ^ 8;
+	uint64_t Seed2 = A5HASH_U64_C( 0x452821E638D01377 ) ^ 8;
+	uint64_t BestScore = 0;
+	size_t Best = 0;
+	size_t i;
+
+	a5hash_umul128( Seed2 ^ ( KeyHash & A5HASH_VAL10 ),
+		Seed1 ^ ( KeyHash & A5HASH_VAL01 ), &Seed1, &Seed2 );
+
+	for( i = 0; i < NodeCount; i++ )
+	{
+		const uint64_t Score = a5hash_msg(
+			(const uint8_t*) ( NodeIds + i ), 8, Seed1, Seed2, 0 );
+
+		if( Score > BestScore )
+		{
+			BestScore = Score;
+			Best = i;
+		}
+	}
+
+	return( Best );
+}
+
 #if defined( A5HASH_NS )
 
 } // namespace A5HASH_NS
@@ -842,9 +1832,25 @@ namespace {
 
 using A5HASH_NS :: a5hash_umul128;
 using A5HASH_NS :: a5hash;
+using A5HASH_NS :: a5hash_le;
+using A5HASH_NS :: a5hash_utf16;
+using A5HASH_NS :: a5hash_u64;
+using A5HASH_NS :: a5hash_u64_batch;
+using A5HASH_NS :: a5hash_kmers;
+using A5HASH_NS :: a5hash_batch;
+using A5HASH_NS :: a5hash_flow4;
+using A5HASH_NS :: a5hash_flow6;
 using A5HASH_NS :: a5hash32;
 using A5HASH_NS :: a5hash128;
+using A5HASH_NS :: a5hash128_le;
+using A5HASH_NS :: a5hash128_batch;
 using A5HASH_NS :: a5rand;
+using A5HASH_NS :: a5hash_reduce;
+using A5HASH_NS :: a5hash_reduce_batch;
+using A5HASH_NS :: a5hash_split;
+using A5HASH_NS :: a5hash_split_batch;
+using A5HASH_NS :: a5hash_jump;
+using A5HASH_NS :: a5hash_rendezvous;
 
 } // namespace
 
@@ -867,8 +1873,15 @@ using A5HASH_NS :: a5rand;
 #undef A5HASH_ICC_GCC
 #undef A5HASH_GCC_BUILTINS
 #undef A5HASH_BMI2
+#undef A5HASH_LITTLE_ENDIAN
+#undef A5HASH_BIG_ENDIAN
 #undef A5HASH_STATIC
 #undef A5HASH_INLINE
 #undef A5HASH_INLINE_F
 
+#if defined( A5HASH_INSTRUMENT_DEFAULT )
+	#undef A5HASH_INSTRUMENT
+	#undef A5HASH_INSTRUMENT_DEFAULT
+#endif // defined( A5HASH_INSTRUMENT_DEFAULT )
+
 #endif // A5HASH_INCLUDED
@@ -0,0 +1,514 @@
+/**
+ * @file a5hash_check.c
+ *
+ * @brief Equivalence checks of the "a5hash.h" functions.
+ *
+ * A deterministic driver that compares the results of the derived hash
+ * functions (fixed-length, batch, byte-order-independent, UTF-16, k-mer and
+ * flow hashing) to the results of the `a5hash()` and `a5hash128()` functions
+ * for the corresponding messages, and checks `a5hash()`, `a5hash32()` and
+ * `a5hash128()` against known values. All inputs are generated by the
+ * `a5rand()` PRNG with fixed initial seeds. Returns 0 if all checks pass.
+ *
+ * Needs no build system, can be compiled as C or C++, e.g.:
+ *
+ * cc -std=c99 -O2 a5hash_check.c -o a5hash_check && ./a5hash_check
+ *
+ * It should be also compiled with `-DA5HASH_LE_PORTABLE` to check the
+ * portable little-endian loads.
+ *
+ * Description is available at https://github.com/avaneev/a5hash
+ *
+ * LICENSE:
+ *
+ * Copyright (c) 2025 Aleksey Vaneev
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include "a5hash.h"
+
+static uint64_t RndSeed1 = 1;
+static uint64_t RndSeed2 = 2;
+static int Fails = 0;
+
+#define CHECK( c ) check( c, #c, __LINE__ )
+
+static void check( const int c, const char* const Expr, const int Line )
+{
+	if( !c )
+	{
+		if( Fails < 20 )
+		{
+			printf( "FAILED: %s (line %i)\n", Expr, Line );
+		}
+
+		Fails++;
+	}
+}
+
+static uint64_t rnd( void )
+{
+	return( a5rand( &RndSeed1, &RndSeed2 ));
+}
+
+static uint64_t u64c( const uint32_t hi, const uint32_t lo )
+{
+	return( (uint64_t) hi << 32 | lo );
+}
+
+/**
+ * Checks `a5hash()`, `a5hash32()` and `a5hash128()` against known values:
+ * the values given in the README, and a digest of hashes over lengths 0 to
+ * 1099 at 4 pointer offsets.
+ */
+
+static void check_known( void )
+{
+	static const char s1[] = "This is a test of a5hash.";
+	static const char s2[] = "7 chars";
+	static const char s3[] = "This is a test of a5hash128.";
+	uint8_t Buf[ 1200 ];
+	uint64_t s1r = 1, s2r = 1;
+	uint64_t Acc = 0;
+	uint64_t h, rh;
+	size_t l, k;
+
+	CHECK( a5hash( s1, strlen( s1 ), 0 ) == u64c( 0xa04d5b1d, 0x10d1f246 ));
+	CHECK( a5hash( s2, strlen( s2 ), 0 ) == u64c( 0xe49a0cc7, 0x2256bbac ));
+
+	h = a5hash128( s3, strlen( s3 ), 0, &rh );
+	CHECK( h == u64c( 0xdd2f4270, 0x07acd1b2 ));
+	CHECK( rh == u64c( 0x36092258, 0x42ec8020 ));
+
+	for( l = 0; l < 1200; l++ )
+	{
+		Buf[ l ] = (uint8_t) a5rand( &s1r, &s2r );
+	}
+
+	for( k = 0; k < 4; k++ )
+	{
+		const uint64_t Seed = ( k == 0 ? 0 : a5rand( &s1r, &s2r ));
+
+		for( l = 0; l < 1100; l++ )
+		{
+			Acc ^= a5hash( Buf + k, l, Seed ) + l;
+			Acc = Acc * 31 + a5hash32( Buf + k, l, (uint32_t) Seed );
+			Acc = Acc * 31 + a5hash128( Buf + k, l, Seed, &rh );
+			Acc ^= rh * 7;
+			Acc = Acc * 31 + a5hash128( Buf + k, l, Seed, 0 );
+		}
+	}
+
+	CHECK( Acc == u64c( 0x734cdf06, 0x95779ff5 ));
+}
+
+/**
+ * Checks `a5hash_le()` and `a5hash128_le()` over lengths 0 to 599 at
+ * 8 pointer offsets.
+ */
+
+static void check_le( void )
+{
+	uint8_t Buf[ 608 ];
+	size_t l, k;
+
+	for( l = 0; l < sizeof( Buf ); l++ )
+	{
+		Buf[ l ] = (uint8_t) rnd();
+	}
+
+	for( l = 0; l < 600; l++ )
+	{
+		for( k = 0; k < 8; k++ )
+		{
+			const uint64_t Seed = rnd();
+			uint64_t rh1, rh2;
+
+			CHECK( a5hash_le( Buf + k, l, Seed ) ==
+				a5hash( Buf + k, l, Seed ));
+
+			CHECK( a5hash128_le( Buf + k, l, Seed, &rh1 ) ==
+				a5hash128( Buf + k, l, Seed, &rh2 ));
+
+			CHECK( rh1 == rh2 );
+
+			CHECK( a5hash128_le( Buf + k, l, Seed, 0 ) ==
+				a5hash128( Buf + k, l, Seed, 0 ));
+		}
+	}
+}
+
+/**
+ * Checks `a5hash_u64()` and `a5hash_u64_batch()` against `a5hash()` of
+ * 8-byte messages.
+ */
+
+static void check_u64( void )
+{
+	uint64_t Keys[ 257 ];
+	uint64_t Hashes[ 257 ];
+	int j;
+	size_t i;
+
+	for( j = 0; j < 400; j++ )
+	{
+		const uint64_t Seed = ( j == 0 ? 0 : rnd() );
+		const size_t Count = (size_t) ( rnd() % 258 );
+
+		for( i = 0; i < Count; i++ )
+		{
+			Keys[ i ] = ( j & 1 ? rnd() : rnd() & 0xFFFF );
+		}
+
+		a5hash_u64_batch( Keys, Count, Seed, Hashes );
+
+		for( i = 0; i < Count; i++ )
+		{
+			CHECK( a5hash_u64( Keys[ i ], Seed ) ==
+				a5hash( Keys + i, 8, Seed ));
+
+			CHECK( Hashes[ i ] == a5hash( Keys + i, 8, Seed ));
+		}
+	}
+}
+
+/**
+ * Checks `a5hash_batch()` and `a5hash128_batch()` over key lengths 0 to 129
+ * at 8 pointer offsets, with random strides.
+ */
+
+static void check_batch( void )
+{
+	uint8_t Buf[ 8 + 137 * 16 ];
+	uint64_t Hashes[ 32 ];
+	size_t l, k, i;
+
+	for( i = 0; i < sizeof( Buf ); i++ )
+	{
+		Buf[ i ] = (uint8_t) rnd();
+	}
+
+	for( l = 0; l < 130; l++ )
+	{
+		for( k = 0; k < 8; k++ )
+		{
+			const uint64_t Seed = rnd();
+			const size_t Stride = l + (size_t) ( rnd() % 8 );
+			const size_t Count = (size_t) ( rnd() % 17 );
+			uint64_t rh;
+
+			a5hash_batch( Buf + k, Stride, l, Count, Seed, Hashes );
+
+			for( i = 0; i < Count; i++ )
+			{
+				CHECK( Hashes[ i ] ==
+					a5hash( Buf + k + Stride * i, l, Seed ));
+			}
+
+			a5hash128_batch( Buf + k, Stride, l, Count, Seed, Hashes );
+
+			for( i = 0; i < Count; i++ )
+			{
+				CHECK( Hashes[ i * 2 ] ==
+					a5hash128( Buf + k + Stride * i, l, Seed, &rh ));
+
+				CHECK( Hashes[ i * 2 + 1 ] == rh );
+			}
+		}
+	}
+}
+
+/**
+ * Reference UTF-16 to UTF-8 conversion, with unpaired surrogates converted
+ * to U+FFFD.
+ */
+
+static size_t utf16_to_utf8( const uint16_t* const s, const size_t n,
+	uint8_t* const d )
+{
+	size_t l = 0;
+	size_t i;
+
+	for( i = 0; i < n; i++ )
+	{
+		uint32_t c = s[ i ];
+
+		if( c >= 0xD800 && c < 0xDC00 && i + 1 < n &&
+			s[ i + 1 ] >= 0xDC00 && s[ i + 1 ] < 0xE000 )
+		{
+			c = 0x10000 + (( c - 0xD800 ) << 10 ) + ( s[ i + 1 ] - 0xDC00 );
+			i++;
+
+			d[ l++ ] = (uint8_t) ( 0xF0 | c >> 18 );
+			d[ l++ ] = (uint8_t) ( 0x80 | ( c >> 12 & 0x3F ));
+			d[ l++ ] = (uint8_t) ( 0x80 | ( c >> 6 & 0x3F ));
+			d[ l++ ] = (uint8_t) ( 0x80 | ( c & 0x3F ));
+			continue;
+		}
+
+		if( c >= 0xD800 && c < 0xE000 )
+		{
+			c = 0xFFFD;
+		}
+
+		if( c < 0x80 )
+		{
+			d[ l++ ] = (uint8_t) c;
+		}
+		else
+		if( c < 0x800 )
+		{
+			d[ l++ ] = (uint8_t) ( 0xC0 | c >> 6 );
+			d[ l++ ] = (uint8_t) ( 0x80 | ( c & 0x3F ));
+		}
+		else
+		{
+			d[ l++ ] = (uint8_t) ( 0xE0 | c >> 12 );
+			d[ l++ ] = (uint8_t) ( 0x80 | ( c >> 6 & 0x3F ));
+			d[ l++ ] = (uint8_t) ( 0x80 | ( c & 0x3F ));
+		}
+	}
+
+	return( l );
+}
+
+/**
+ * Checks `a5hash_utf16()` over 2*10^5 random strings, with ASCII runs,
+ * 2- and 3-byte characters, paired and unpaired surrogates.
+ */
+
+static void check_utf16( void )
+{
+	uint16_t s[ 160 ];
+	uint8_t d[ 160 * 3 ];
+	int j;
+	size_t n, i;
+
+	for( j = 0; j < 200000; j++ )
+	{
+		const uint64_t Seed = ( j & 1 ? rnd() : 0 );
+		const int IsAscii = ( j % 4 == 0 );
+
+		n = (size_t) ( rnd() % 160 );
+
+		for( i = 0; i < n; i++ )
+		{
+			const uint64_t x = rnd();
+			const int m = ( IsAscii ? 0 : (int) ( x % 10 ));
+
+			if( m < 5 )
+			{
+				s[ i ] = (uint16_t) ( x >> 8 & 0x7F );
+			}
+			else
+			if( m == 5 )
+			{
+				s[ i ] = (uint16_t) ( 0x80 + ( x >> 8 ) % 0x780 );
+			}
+			else
+			if( m == 6 )
+			{
+				s[ i ] = (uint16_t) ( 0x800 + ( x >> 8 ) % 0xF800 );
+			}
+			else
+			if( m == 7 )
+			{
+				s[ i ] = (uint16_t) ( 0xD800 | ( x >> 8 & 0x3FF ));
+
+				if(( x >> 30 & 1 ) != 0 && i + 1 < n )
+				{
+					i++;
+					s[ i ] = (uint16_t) ( 0xDC00 | ( x >> 40 & 0x3FF ));
+				}
+			}
+			else
+			if( m == 8 )
+			{
+				s[ i ] = (uint16_t) ( 0xDC00 | ( x >> 8 & 0x3FF ));
+			}
+			else
+			{
+				s[ i ] = (uint16_t) ( 0xE000 + ( x >> 8 ) % 0x2000 );
+			}
+		}
+
+		CHECK( a5hash_utf16( s, n, Seed ) ==
+			a5hash( d, utf16_to_utf8( s, n, d ), Seed ));
+	}
+}
+
+/**
+ * Checks `a5hash_kmers()` for every k from 1 to 32 against naive canonical
+ * k-mer packing, and for out-of-range k values.
+ */
+
+static void check_kmers( void )
+{
+	static const char Nucs[] = "ACGTacgt";
+	char Seq[ 300 ];
+	uint64_t Hashes[ 300 ];
+	size_t k, n, i, p;
+	int j;
+
+	for( k = 1; k <= 32; k++ )
+	{
+		for( j = 0; j < 20; j++ )
+		{
+			const uint64_t Seed = ( j == 0 ? 0 : rnd() );
+
+			n = (size_t) ( rnd() % 300 );
+
+			for( i = 0; i < n; i++ )
+			{
+				Seq[ i ] = Nucs[ rnd() % 8 ];
+			}
+
+			CHECK( a5hash_kmers( Seq, n, k, Seed, Hashes ) ==
+				( n < k ? 0 : n - k + 1 ));
+
+			for( p = 0; p + k <= n; p++ )
+			{
+				uint64_t f = 0;
+				uint64_t r = 0;
+
+				for( i = 0; i < k; i++ )
+				{
+					const int c = Seq[ p + i ] | 0x20;
+					const int rc = Seq[ p + k - 1 - i ] | 0x20;
+
+					f = f << 2 | (uint64_t) ( c == 'a' ? 0 : c == 'c' ? 1 :
+						c == 't' ? 2 : 3 );
+
+					r = r << 2 | (uint64_t) ( rc == 'a' ? 2 : rc == 'c' ? 3 :
+						rc == 't' ? 0 : 1 );
+				}
+
+				CHECK( Hashes[ p ] == a5hash_u64( f < r ? f : r, Seed ));
+			}
+		}
+	}
+
+	CHECK( a5hash_kmers( "ACGTACGTA", 9, 0, 0, Hashes ) == 0 );
+	CHECK( a5hash_kmers( "ACGTACGTA", 9, 33, 0, Hashes ) == 0 );
+	CHECK( a5hash_kmers( 0, 0, 0, 0, Hashes ) == 0 );
+	CHECK( a5hash_kmers( 0, 0, 5, 0, Hashes ) == 0 );
+}
+
+/**
+ * Checks `a5hash_flow4()` and `a5hash_flow6()` for symmetry, and against
+ * `a5hash()` of the messages with the ordered endpoints.
+ */
+
+static void check_flow( void )
+{
+	uint8_t a[ 16 ], b[ 16 ], m[ 37 ];
+	int j;
+	size_t i;
+
+	for( j = 0; j < 20000; j++ )
+	{
+		const uint64_t Seed = ( j & 1 ? rnd() : 0 );
+		const uint8_t Proto = (uint8_t) rnd();
+		uint16_t sp, dp;
+		uint32_t sa, da;
+		int c;
+
+		for( i = 0; i < 16; i++ )
+		{
+			a[ i ] = (uint8_t) rnd();
+			b[ i ] = ( j % 3 == 0 ? a[ i ] : (uint8_t) rnd() );
+		}
+
+		sp = (uint16_t) rnd();
+		dp = ( j % 5 == 0 ? sp : (uint16_t) rnd() );
+
+		CHECK( a5hash_flow4( a, b, sp, dp, Proto, Seed ) ==
+			a5hash_flow4( b, a, dp, sp, Proto, Seed ));
+
+		CHECK( a5hash_flow6( a, b, sp, dp, Proto, Seed ) ==
+			a5hash_flow6( b, a, dp, sp, Proto, Seed ));
+
+		memcpy( &sa, a, 4 );
+		memcpy( &da, b, 4 );
+
+		if( sa < da || ( sa == da && sp <= dp ))
+		{
+			memcpy( m, a, 4 );
+			memcpy( m + 4, b, 4 );
+			memcpy( m + 8, &sp, 2 );
+			memcpy( m + 10, &dp, 2 );
+		}
+		else
+		{
+			memcpy( m, b, 4 );
+			memcpy( m + 4, a, 4 );
+			memcpy( m + 8, &dp, 2 );
+			memcpy( m + 10, &sp, 2 );
+		}
+
+		m[ 12 ] = Proto;
+
+		CHECK( a5hash_flow4( a, b, sp, dp, Proto, Seed ) ==
+			a5hash( m, 13, Seed ));
+
+		c = memcmp( a, b, 16 );
+
+		if( c < 0 || ( c == 0 && sp <= dp ))
+		{
+			memcpy( m, a, 16 );
+			memcpy( m + 16, b, 16 );
+			memcpy( m + 32, &sp, 2 );
+			memcpy( m + 34, &dp, 2 );
+		}
+		else
+		{
+			memcpy( m, b, 16 );
+			memcpy( m + 16, a, 16 );
+			memcpy( m + 32, &dp, 2 );
+			memcpy( m + 34, &sp, 2 );
+		}
+
+		m[ 36 ] = Proto;
+
+		CHECK( a5hash_flow6( a, b, sp, dp, Proto, Seed ) ==
+			a5hash( m, 37, Seed ));
+	}
+}
+
+int main( void )
+{
+	check_known();
+	check_le();
+	check_u64();
+	check_batch();
+	check_utf16();
+	check_kmers();
+	check_flow();
+
+	if( Fails != 0 )
+	{
+		printf( "%i check(s) FAILED\n", Fails );
+		return( 1 );
+	}
+
+	printf( "All checks passed\n" );
+	return( 0 );
+}